@@ -0,0 +1,159 @@
+#ifndef ZUDOKU_BATCH_APP_HPP
+#define ZUDOKU_BATCH_APP_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "app.hpp"
+#include "bounded-queue.hpp"
+
+namespace Zudoku
+{
+    /**
+     * The non-interactive counterpart of App, for solving a large number of CSV files.
+     *
+     * Reading (and parsing), solving and saving are done in three separate threads,
+     * connected together by bounded queues. Tables travel between the stages in batches,
+     * so I/O overlaps with solving, and the pipeline never holds more than a handful of
+     * batches in memory.
+     */
+    class BatchApp: protected App
+    {
+    private:
+        using Self = BatchApp;
+        using This = Self &;
+
+    public:
+        struct Options
+        {
+            std::vector<std::string> inputCsvFilePaths;
+            std::size_t batchSize = 64;
+
+            /**
+             * Whether to race several solving strategies on each table, using
+             * PortfolioSolver.
+             */
+            bool portfolio = false;
+
+            /**
+             * Whether to keep searching after the first solution, to count tables with
+             * more than one solution in metrics. The portfolio solver ignores it.
+             */
+            bool checkUniqueness = false;
+
+            /**
+             * Where to write metrics in Prometheus text format, at the end of the run, and
+             * whenever SIGUSR1 is received. Empty means no metrics file.
+             */
+            std::string metricsFilePath;
+        };
+
+        BatchApp() = delete;
+
+        BatchApp(Options);
+
+        /**
+         * Parses command-line arguments, in the form of:
+         *
+         *     --batch [--batch-size N] [--portfolio] [--check-uniqueness]
+         *         [--metrics FILE] FILE...
+         */
+        static Options parseArguments(int argc, const char *const argv[]);
+
+        This run();
+
+    protected:
+        static std::size_t parseBatchSize(const std::string &);
+
+        /**
+         * A single input file, on its way through the pipeline. Once an error occurs,
+         * later stages leave the job alone, and the error is only reported.
+         */
+        struct Job
+        {
+            std::string inputCsvFilePath;
+            rapidcsv::Document csvData;
+            SudokuSolver::Table table;
+            std::string error;
+
+            /**
+             * Whether the file was read, but its data is not a proper table (e.g. wrong
+             * dimensions or out of range values). Such jobs are still counted in
+             * metrics, as invalid.
+             */
+            bool isDataInvalid;
+        };
+
+        using Batch = std::vector<Job>;
+
+        /**
+         * Number of batches each queue can hold, before blocking its producer stage.
+         */
+        constexpr static std::size_t queueCapacity = 8;
+
+        using Queue = BoundedQueue<Batch, queueCapacity>;
+
+        struct StageStats
+        {
+            const std::string name;
+            std::size_t jobsCount = 0;
+            std::chrono::steady_clock::duration busyTime{0}, waitTime{0};
+        };
+
+        /**
+         * How often the metrics dump request flag is checked. A signal handler could only
+         * set a flag, and not notify a condition variable, so it must be polled.
+         */
+        constexpr static std::chrono::milliseconds metricsDumpPollInterval{100};
+
+        static std::atomic<bool> metricsDumpRequested;
+
+        Options options;
+
+        /**
+         * Whether all stages are done, waking the metrics dumper up right away.
+         */
+        bool finished = false;
+        std::mutex finishedMutex;
+        std::condition_variable finishedCondition;
+
+        Queue readQueue, solveQueue;
+
+        struct {
+            StageStats reader{"reader"}, solver{"solver"}, writer{"writer"};
+        } stageStats;
+
+        struct {
+            std::size_t succeeded = 0, failed = 0;
+        } jobsCount;
+
+        /**
+         * Number of tables each portfolio entry solved first, for tuning the defaults.
+         * Only touched by the solver stage.
+         */
+        std::map<std::string, std::size_t> portfolioWinsCount;
+
+        void readStage();
+        void solveStage();
+        void writeStage();
+        void metricsDumpStage();
+
+        Job readJob(const std::string &);
+        This solveJob(Job &);
+        This writeJob(Job &);
+
+        static std::string getOutputCsvFilePath(const std::string &);
+
+        static void requestMetricsDump(int signal);
+        This dumpMetrics();
+
+        This reportStats(std::chrono::steady_clock::duration);
+    };
+}
+
+#endif // ZUDOKU_BATCH_APP_HPP
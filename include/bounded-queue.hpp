@@ -0,0 +1,195 @@
+#ifndef ZUDOKU_BOUNDED_QUEUE_HPP
+#define ZUDOKU_BOUNDED_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace Zudoku
+{
+    /**
+     * A fixed-capacity lock-free queue, connecting exactly one producer thread to exactly
+     * one consumer thread.
+     *
+     * Pushing into a full queue blocks the producer until the consumer makes room, which
+     * is what keeps the memory usage of a pipeline flat, no matter how large its input
+     * is. Popping from an empty queue blocks the consumer until either a new element
+     * arrives, or the producer closes the queue.
+     *
+     * A blocked side spins for a short while, and then sleeps on a condition variable,
+     * so an idle stage does not burn a whole core. The other side only touches the
+     * mutex if it sees someone is sleeping.
+     */
+    template<typename T, std::size_t Capacity>
+    class BoundedQueue
+    {
+    private:
+        using Self = BoundedQueue;
+        using This = Self &;
+
+    public:
+        /**
+         * Statistics about the number of elements waiting in the queue, sampled on each
+         * push.
+         */
+        struct OccupancyStats
+        {
+            std::size_t maximum = 0;
+            std::size_t samplesSum = 0;
+            std::size_t samplesCount = 0;
+
+            double average() const noexcept
+            {
+                return this->samplesCount == 0 ? 0 :
+                    static_cast<double>(this->samplesSum) / this->samplesCount;
+            }
+        };
+
+        BoundedQueue() = default;
+
+        BoundedQueue(const Self &) = delete;
+        This operator=(const Self &) = delete;
+
+        constexpr static std::size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+        /**
+         * Must only be called from the producer thread.
+         */
+        void push(T &&value)
+        {
+            const std::size_t tail = this->tail.load(std::memory_order_relaxed);
+
+            // Backpressure: wait for the consumer to catch up
+            this->waitUntil(this->producerWaiting, [this, tail] {
+                return tail - this->head.load(std::memory_order_acquire) != Capacity;
+            });
+
+            this->sampleOccupancy(tail - this->head.load(std::memory_order_relaxed));
+
+            this->slots[tail % Capacity] = std::move(value);
+            this->tail.store(tail + 1, std::memory_order_seq_cst);
+
+            this->wakeUp(this->consumerWaiting);
+        }
+
+        /**
+         * Tells the consumer no more elements are coming. Must only be called from the
+         * producer thread, after its last push.
+         */
+        void close()
+        {
+            this->closed.store(true, std::memory_order_seq_cst);
+
+            this->wakeUp(this->consumerWaiting);
+        }
+
+        /**
+         * Must only be called from the consumer thread. Returns false if the queue is
+         * closed and there is nothing left to be popped.
+         */
+        bool pop(T &result)
+        {
+            const std::size_t head = this->head.load(std::memory_order_relaxed);
+
+            this->waitUntil(this->consumerWaiting, [this, head] {
+                return head != this->tail.load(std::memory_order_acquire) ||
+                    this->closed.load(std::memory_order_acquire);
+            });
+
+            // A push might have happened right before closing
+            if (head == this->tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            result = std::move(this->slots[head % Capacity]);
+            this->head.store(head + 1, std::memory_order_seq_cst);
+
+            this->wakeUp(this->producerWaiting);
+
+            return true;
+        }
+
+        /**
+         * Should only be read after both sides are done with the queue.
+         */
+        const OccupancyStats &getOccupancyStats() const noexcept
+        {
+            return this->occupancyStats;
+        }
+
+    private:
+        std::array<T, Capacity> slots;
+
+        /*
+         * Both indices only grow, and the slot is found by taking the remainder. Keeping
+         * them on separate cache lines prevents the two threads from invalidating each
+         * other's cache on every operation.
+         */
+        alignas(64) std::atomic<std::size_t> head = 0;
+        alignas(64) std::atomic<std::size_t> tail = 0;
+
+        std::atomic<bool> closed = false;
+
+        /**
+         * Number of times a blocked side checks again, before going to sleep.
+         */
+        constexpr static unsigned int spinsCount = 64;
+
+        std::mutex sleepMutex;
+        std::condition_variable wakeUpCondition;
+        std::atomic<bool> producerWaiting = false, consumerWaiting = false;
+
+        // Only touched by the producer
+        OccupancyStats occupancyStats;
+
+        template<typename Predicate>
+        void waitUntil(std::atomic<bool> &waiting, Predicate isReady)
+        {
+            for (unsigned int i = 0; i < Self::spinsCount; i++) {
+                if (isReady()) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+
+            std::unique_lock<std::mutex> lock{this->sleepMutex};
+
+            /*
+             * The flag is raised before checking again, and the other side checks the
+             * flag after publishing its change, so at least one of the two sees the
+             * other, and no wake-up is lost. The predicate only acquire-loads, so the
+             * fence keeps its loads from being ordered before the flag store.
+             */
+            waiting.store(true, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            this->wakeUpCondition.wait(lock, isReady);
+            waiting.store(false, std::memory_order_relaxed);
+        }
+
+        void wakeUp(std::atomic<bool> &waiting)
+        {
+            if (waiting.load(std::memory_order_seq_cst)) {
+                // Locking ensures the sleeper is either before its check, or waiting
+                std::lock_guard<std::mutex> lock{this->sleepMutex};
+                this->wakeUpCondition.notify_all();
+            }
+        }
+
+        void sampleOccupancy(std::size_t occupancy) noexcept
+        {
+            if (occupancy > this->occupancyStats.maximum) {
+                this->occupancyStats.maximum = occupancy;
+            }
+            this->occupancyStats.samplesSum += occupancy;
+            this->occupancyStats.samplesCount++;
+        }
+    };
+}
+
+#endif // ZUDOKU_BOUNDED_QUEUE_HPP
@@ -0,0 +1,127 @@
+#ifndef ZUDOKU_BUILTIN_PUZZLES_HPP
+#define ZUDOKU_BUILTIN_PUZZLES_HPP
+
+#include <array>
+
+#include "compile-time-solver.hpp"
+
+namespace Zudoku
+{
+    /**
+     * Puzzles embedded in the program, along with their expected solutions. They are the
+     * same as the valid ones in examples/sudoku-table/ directory.
+     */
+    class BuiltinPuzzles // static
+    {
+    public:
+        BuiltinPuzzles() = delete;
+
+        struct Entry
+        {
+            CompileTimeSolver::Grid puzzle, solution;
+        };
+
+        constexpr static std::array<Entry, 3> examples = {{
+            {
+                CompileTimeSolver::parse(
+                    ".....46.."
+                    "....9...."
+                    "34...2..9"
+                    "..64..7.."
+                    "42..8..63"
+                    "..7..39.."
+                    "1..8...72"
+                    "....3...."
+                    "..47....."
+                ),
+                CompileTimeSolver::parse(
+                    "982154637"
+                    "765398241"
+                    "341672859"
+                    "836419725"
+                    "429587163"
+                    "517263984"
+                    "193846572"
+                    "278935416"
+                    "654721398"
+                ),
+            },
+            {
+                CompileTimeSolver::parse(
+                    "9..43...."
+                    "7...6..39"
+                    "..6..5..."
+                    ".78....9."
+                    "15.....67"
+                    ".6....32."
+                    "...8..4.."
+                    "52..7...6"
+                    "....26..3"
+                ),
+                CompileTimeSolver::parse(
+                    "982431675"
+                    "745268139"
+                    "316795248"
+                    "278613594"
+                    "153942867"
+                    "469587321"
+                    "637859412"
+                    "521374986"
+                    "894126753"
+                ),
+            },
+            {
+                CompileTimeSolver::parse(
+                    ".598.263."
+                    ".4.....8."
+                    "...5.6..."
+                    "..81.59.."
+                    ".9.....5."
+                    "...4.9..."
+                    ".3..2..6."
+                    "..26.17.."
+                    "..69.32.."
+                ),
+                CompileTimeSolver::parse(
+                    "759842631"
+                    "641397582"
+                    "823516497"
+                    "268135974"
+                    "394278156"
+                    "517469328"
+                    "135724869"
+                    "982651743"
+                    "476983215"
+                ),
+            },
+        }};
+
+        /**
+         * Tells whether the compile-time solver finds the expected solution of the
+         * entry, and whether the expected solution is actually a solution.
+         */
+        constexpr static bool verify(std::size_t index) noexcept
+        {
+            const Entry &entry = examples[index];
+            const CompileTimeSolver::Result result = CompileTimeSolver::solve(entry.puzzle);
+
+            if (
+                !result.solved ||
+                !CompileTimeSolver::isSolutionOf(entry.solution, entry.puzzle)
+            ) {
+                return false;
+            }
+
+            // std::array comparison is not constexpr in C++17
+            for (std::size_t i = 0; i < result.grid.size(); i++) {
+                if (result.grid[i] != entry.solution[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+}
+
+#endif // ZUDOKU_BUILTIN_PUZZLES_HPP
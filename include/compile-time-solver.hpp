@@ -0,0 +1,316 @@
+#ifndef ZUDOKU_COMPILE_TIME_SOLVER_HPP
+#define ZUDOKU_COMPILE_TIME_SOLVER_HPP
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include "sudoku-tables.hpp"
+
+namespace Zudoku
+{
+    /**
+     * A solver usable in constant expressions, so puzzles embedded in the source code
+     * could be solved and verified at build time.
+     *
+     * Unlike SudokuSolver, it uses no dynamic memory and throws nothing while solving.
+     * The search state is held in fixed-size arrays: A bit mask of used values per block,
+     * a list of still-empty cells, and a path of filled cells with their untried
+     * candidates. At each node, the empty cell with the least candidates is filled next.
+     *
+     * Evaluating it in a constant expression is subject to the compiler limits (e.g.
+     * -fconstexpr-ops-limit of GCC, or -fconstexpr-steps of Clang), so each puzzle should
+     * be solved in a constant expression of its own.
+     */
+    class CompileTimeSolver // static
+    {
+    public:
+        CompileTimeSolver() = delete;
+
+        /**
+         * Cell values in row-major order, 0 meaning an empty cell.
+         */
+        using Grid = std::array<std::uint8_t, SudokuTables::cellsCount>;
+
+        struct Result
+        {
+            /**
+             * False if the puzzle is either invalid or has no solution.
+             */
+            bool solved;
+
+            Grid grid;
+            std::size_t nodesCount;
+        };
+
+        /**
+         * Parses a grid written as a string of exactly 81 cells, each being a digit, with
+         * 0 or '.' meaning empty. Any other character (e.g. whitespace) is skipped, so
+         * rows could be written on separate lines. A malformed string throws, which
+         * fails the compilation in constant expressions.
+         */
+        constexpr static Grid parse(std::string_view text)
+        {
+            Grid grid{};
+            std::size_t position = 0;
+
+            for (char c: text) {
+                if (c != '.' && (c < '0' || c > '9')) {
+                    continue;
+                }
+                if (position == grid.size()) {
+                    throw std::invalid_argument("Expected exactly 81 cells, got more");
+                }
+                grid[position++] = c == '.' ? 0 : c - '0';
+            }
+
+            if (position != grid.size()) {
+                throw std::invalid_argument("Expected exactly 81 cells, got less");
+            }
+
+            return grid;
+        }
+
+        constexpr static Result solve(const Grid &puzzle) noexcept
+        {
+            Result result = {false, puzzle, 0};
+            Grid &grid = result.grid;
+
+            UsedValues usedValues{};
+
+            for (std::size_t cell = 0; cell < grid.size(); cell++) {
+                const unsigned int value = grid[cell];
+
+                if (value > 9) {
+                    return result;
+                }
+                if (value != 0) {
+                    if ((Self::getCandidates(usedValues, cell) & (1 << value)) == 0) {
+                        return result;
+                    }
+                    Self::toggleValue(usedValues, cell, value);
+                }
+            }
+
+            /*
+             * Empty cells of the puzzle. The first ones are still empty, and the rest (in
+             * reverse order) are the path, i.e. the cells filled so far, each at its own
+             * depth. Filling a cell is then just swapping it to the end of the
+             * still-empty part, and reverting back needs no swapping at all.
+             */
+            std::uint8_t emptyCells[SudokuTables::cellsCount]{};
+            std::size_t emptyCellsCount = 0;
+
+            for (std::size_t cell = 0; cell < grid.size(); cell++) {
+                if (grid[cell] == 0) {
+                    emptyCells[emptyCellsCount++] = cell;
+                }
+            }
+
+            std::uint16_t pathCandidates[SudokuTables::cellsCount]{};
+            std::size_t depth = 0;
+
+            const auto getPathCell = [&](std::size_t pathDepth) {
+                return emptyCells[emptyCellsCount - 1 - pathDepth];
+            };
+
+            while (true) {
+                result.nodesCount++;
+
+                const std::size_t stillEmptyCount = emptyCellsCount - depth;
+
+                if (stillEmptyCount == 0) {
+                    result.solved = true;
+                    return result;
+                }
+
+                std::size_t bestIndex = 0;
+                std::uint16_t bestCandidates = 0;
+                unsigned int bestCandidatesCount = 10;
+
+                // No need to look further after a cell with zero or one candidate
+                for (
+                    std::size_t i = 0;
+                    i < stillEmptyCount && bestCandidatesCount > 1;
+                    i++
+                ) {
+                    // The same as getCandidates(), saving a call per cell
+                    const std::uint8_t (&indices)[SudokuTables::blockTypesCount] =
+                        Self::usedValuesIndices.cells[emptyCells[i]];
+                    const std::uint16_t candidates = ~(
+                        usedValues[indices[0]] |
+                        usedValues[indices[1]] |
+                        usedValues[indices[2]]
+                    ) & allValuesMask;
+                    const unsigned int candidatesCount =
+                        Self::bitsCounts.masks[candidates];
+
+                    if (candidatesCount < bestCandidatesCount) {
+                        bestIndex = i;
+                        bestCandidates = candidates;
+                        bestCandidatesCount = candidatesCount;
+                    }
+                }
+
+                if (bestCandidatesCount != 0) {
+                    // std::swap() is not constexpr in C++17
+                    const std::uint8_t bestCell = emptyCells[bestIndex];
+                    emptyCells[bestIndex] = emptyCells[stillEmptyCount - 1];
+                    emptyCells[stillEmptyCount - 1] = bestCell;
+
+                    pathCandidates[depth] = bestCandidates;
+                    Self::fillWithNextCandidate(
+                        grid, usedValues, bestCell, pathCandidates[depth]
+                    );
+                    depth++;
+                    continue;
+                }
+
+                // Reverting back to the most recent cell having any untried candidates
+                do {
+                    if (depth == 0) {
+                        return result;
+                    }
+                    depth--;
+
+                    const std::size_t cell = getPathCell(depth);
+                    Self::toggleValue(usedValues, cell, grid[cell]);
+                    grid[cell] = 0;
+                } while (pathCandidates[depth] == 0);
+
+                Self::fillWithNextCandidate(
+                    grid, usedValues, getPathCell(depth), pathCandidates[depth]
+                );
+                depth++;
+            }
+        }
+
+        /**
+         * Tells whether the grid is completely and correctly filled, keeping all filled
+         * cells of the puzzle.
+         */
+        constexpr static bool isSolutionOf(
+            const Grid &solution,
+            const Grid &puzzle
+        ) noexcept {
+            for (std::size_t cell = 0; cell < solution.size(); cell++) {
+                const std::uint8_t value = solution[cell];
+
+                if (value == 0 || value > 9) {
+                    return false;
+                }
+                if (puzzle[cell] != 0 && puzzle[cell] != value) {
+                    return false;
+                }
+
+                for (std::uint8_t peer: SudokuTables::peers[cell]) {
+                    if (solution[peer] == value) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+    private:
+        using Self = CompileTimeSolver;
+
+        constexpr static std::uint16_t allValuesMask = 0b1111111110;
+
+        /**
+         * Used values of all 27 blocks, indexed by block type and then block index.
+         *
+         * The search state and the tables it is looked up with are plain arrays rather
+         * than std::array, as each call to its operator[] adds noticeably to the cost of
+         * constant evaluation.
+         */
+        using UsedValues = std::uint16_t[27];
+
+        /**
+         * Number of set bits of every candidates mask, so counting is a single lookup.
+         */
+        struct BitsCounts
+        {
+            std::uint8_t masks[allValuesMask + 1];
+        };
+
+        constexpr static BitsCounts bitsCounts = [] {
+            BitsCounts result{};
+
+            for (std::size_t bits = 1; bits <= allValuesMask; bits++) {
+                result.masks[bits] = result.masks[bits & (bits - 1)] + 1;
+            }
+
+            return result;
+        }();
+
+        /**
+         * Indices of the row, the column and the square of each cell in used values.
+         */
+        struct UsedValuesIndices
+        {
+            std::uint8_t cells[SudokuTables::cellsCount][SudokuTables::blockTypesCount];
+        };
+
+        constexpr static UsedValuesIndices usedValuesIndices = [] {
+            UsedValuesIndices result{};
+
+            for (std::size_t cell = 0; cell < SudokuTables::cellsCount; cell++) {
+                for (std::size_t type = 0; type < SudokuTables::blockTypesCount; type++) {
+                    result.cells[cell][type] =
+                        type * 9 + SudokuTables::blockIndices[cell][type];
+                }
+            }
+
+            return result;
+        }();
+
+        constexpr static std::uint16_t getCandidates(
+            const UsedValues &usedValues,
+            std::size_t cell
+        ) noexcept {
+            const std::uint8_t (&indices)[SudokuTables::blockTypesCount] =
+                Self::usedValuesIndices.cells[cell];
+
+            return ~(
+                usedValues[indices[0]] |
+                usedValues[indices[1]] |
+                usedValues[indices[2]]
+            ) & allValuesMask;
+        }
+
+        constexpr static void toggleValue(
+            UsedValues &usedValues,
+            std::size_t cell,
+            unsigned int value
+        ) noexcept {
+            for (std::uint8_t index: Self::usedValuesIndices.cells[cell]) {
+                usedValues[index] ^= 1 << value;
+            }
+        }
+
+        /**
+         * Fills the cell with the smallest value among the candidates, and removes it
+         * from them.
+         */
+        constexpr static void fillWithNextCandidate(
+            Grid &grid,
+            UsedValues &usedValues,
+            std::size_t cell,
+            std::uint16_t &candidates
+        ) noexcept {
+            unsigned int value = 1;
+            while ((candidates & (1 << value)) == 0) {
+                value++;
+            }
+
+            candidates &= ~(1 << value);
+            grid[cell] = value;
+            Self::toggleValue(usedValues, cell, value);
+        }
+    };
+}
+
+#endif // ZUDOKU_COMPILE_TIME_SOLVER_HPP
@@ -0,0 +1,120 @@
+#ifndef ZUDOKU_GRID_VALIDATOR_HPP
+#define ZUDOKU_GRID_VALIDATOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sudoku-solver.hpp"
+
+namespace Zudoku
+{
+    /**
+     * Checks complete or partial Sudoku grids, without solving them and without throwing
+     * exceptions.
+     *
+     * Checking is done in two passes. The first one only tells whether the grid is valid
+     * or not, using a bit mask for each of the 27 blocks, and is the only one needed for
+     * the common case of valid grids. It checks many grids side by side, one per lane of
+     * vectors. The second (much slower) one finds out every
+     * conflicting cell, and is meant to be run only for invalid grids.
+     */
+    class GridValidator // static
+    {
+    public:
+        GridValidator() = delete;
+
+        /**
+         * Unlike SudokuSolver::Table, any value is accepted here, so out of range values
+         * could be reported instead of being thrown. Values larger than 255 should be
+         * saturated to 255 by the caller.
+         */
+        using Grid = std::array<std::array<std::uint8_t, 9>, 9>;
+
+        struct Options
+        {
+            /**
+             * Whether empty cells (i.e. zeros) are reported as conflicts.
+             */
+            bool requireComplete;
+
+            /**
+             * If not null, filled cells of this puzzle must have the same value in the
+             * grid.
+             */
+            const Grid *puzzle;
+        };
+
+        struct Conflict
+        {
+            enum class Kind
+            {
+                OutOfRange,
+                Empty,
+                PuzzleMismatch,
+                DuplicateInRow,
+                DuplicateInColumn,
+                DuplicateInSquare,
+            };
+
+            Kind kind;
+            SudokuSolver::CellIndex cell;
+
+            /**
+             * For duplicates, the first cell in the block having the same value. For
+             * other kinds, it is the same as cell.
+             */
+            SudokuSolver::CellIndex otherCell;
+
+            unsigned int value;
+        };
+
+        static bool isValid(const Grid &, const Options &) noexcept;
+
+        /**
+         * Checks many grids at once, writing whether each one is valid into results,
+         * which must have room for count elements. Much faster per grid than checking
+         * them one by one.
+         */
+        static void isValid(
+            const Grid *,
+            std::size_t count,
+            bool *results,
+            const Options &
+        ) noexcept;
+
+        /**
+         * Returns all the conflicts, in row-major order of cells, and then blocks. An
+         * empty result means the grid is valid.
+         */
+        static std::vector<Conflict> findConflicts(const Grid &, const Options &);
+
+        static std::string describeConflict(const Conflict &);
+
+    protected:
+        /**
+         * Number of grids checked together in bulk, each in a lane of 16-bit vectors.
+         */
+        constexpr static std::size_t lanesCount = 16;
+
+        /**
+         * Checks at most LanesCount grids, side by side.
+         */
+        template<std::size_t LanesCount>
+        static void checkGroup(
+            const Grid *,
+            std::size_t count,
+            bool *results,
+            const Options &
+        ) noexcept;
+
+        static SudokuSolver::CellIndex getCellIndexInBlock(
+            Conflict::Kind,
+            unsigned int blockIndex,
+            unsigned int positionInBlock
+        ) noexcept;
+    };
+}
+
+#endif // ZUDOKU_GRID_VALIDATOR_HPP
@@ -0,0 +1,140 @@
+#ifndef ZUDOKU_METRICS_HPP
+#define ZUDOKU_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Zudoku
+{
+    /**
+     * Process-wide solving metrics, exportable in Prometheus text format.
+     *
+     * Each thread records into its own shard, using relaxed atomic increments, so
+     * recording never waits on anything. Shards are only merged when reading.
+     */
+    class Metrics // static
+    {
+    public:
+        Metrics() = delete;
+
+        /**
+         * The solving path which has been taken, i.e. a plain SudokuSolver or a
+         * PortfolioSolver.
+         */
+        enum class Engine
+        {
+            Solver,
+            Portfolio,
+        };
+
+        enum class Outcome
+        {
+            Solved,
+            NoSolution,
+            Invalid,
+            MultipleSolutions,
+        };
+
+        static void recordSolve(
+            Engine,
+            Outcome,
+            std::chrono::steady_clock::duration,
+            std::size_t nodesCount
+        );
+
+        /**
+         * Only counts the outcome, for tables rejected before reaching any solver.
+         */
+        static void recordOutcome(Engine, Outcome);
+
+        static std::string toPrometheusText();
+
+        /**
+         * Writes to a temporary file first, and then renames it, so readers never see a
+         * half-written file. Throws std::ios_base::failure on errors.
+         */
+        static void saveToFile(const std::string &);
+
+    protected:
+        constexpr static std::size_t enginesCount = 2;
+        constexpr static std::size_t outcomesCount = 4;
+
+        /**
+         * A histogram with logarithmic buckets, each split into linear sub-buckets (i.e.
+         * the way HDR histograms are), so the relative error of every bucket is bounded
+         * by 1/subBucketsCount, no matter how large the value is.
+         *
+         * Values less than subBucketsCount get a bucket of their own. For the others, the
+         * position of the highest set bit selects the bucket, and the next
+         * subBucketBits bits select the sub-bucket.
+         */
+        struct Histogram
+        {
+            constexpr static unsigned int subBucketBits = 4;
+            constexpr static std::uint64_t subBucketsCount = 1 << subBucketBits;
+            constexpr static std::size_t bucketsCount =
+                (64 - subBucketBits + 1) * subBucketsCount;
+
+            std::array<std::atomic<std::uint64_t>, bucketsCount> counts{};
+            std::atomic<std::uint64_t> sum{0};
+
+            static std::size_t getBucketIndex(std::uint64_t value) noexcept;
+
+            /**
+             * The largest value falling into the bucket.
+             */
+            static std::uint64_t getBucketUpperBound(std::size_t index) noexcept;
+
+            void record(std::uint64_t value) noexcept;
+        };
+
+        struct EngineShard
+        {
+            // In nanoseconds
+            Histogram latency;
+
+            Histogram nodesCount;
+
+            std::array<std::atomic<std::uint64_t>, outcomesCount> outcomeCounts{};
+        };
+
+        using Shard = std::array<EngineShard, enginesCount>;
+
+        struct ShardRegistry
+        {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<Shard>> shards;
+        };
+
+        static ShardRegistry &getShardRegistry();
+
+        /**
+         * The shard of the current thread, which is created and registered on first use.
+         * Shards live until the end of the program, so counts of finished threads are
+         * not lost.
+         */
+        static Shard &getThreadShard();
+
+        template<typename Callback>
+        static void forEachShard(Callback callback)
+        {
+            ShardRegistry &registry = Metrics::getShardRegistry();
+            std::lock_guard<std::mutex> lock{registry.mutex};
+
+            for (const std::unique_ptr<Shard> &shard: registry.shards) {
+                callback(*shard);
+            }
+        }
+
+        static std::string getEngineName(Engine);
+        static std::string getOutcomeName(Outcome);
+    };
+}
+
+#endif // ZUDOKU_METRICS_HPP
@@ -0,0 +1,94 @@
+#ifndef ZUDOKU_PORTFOLIO_SOLVER_HPP
+#define ZUDOKU_PORTFOLIO_SOLVER_HPP
+
+#include <atomic>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "sudoku-solver.hpp"
+
+namespace Zudoku
+{
+    /**
+     * Races several differently-configured solvers on the same table, each in its own
+     * thread, and takes the first answer.
+     *
+     * Every strategy has inputs on which it blows up, but rarely all of them on the same
+     * input. Racing them bounds the solving time by the fastest one. Losers are stopped
+     * cooperatively, by checking a flag between solver steps.
+     */
+    class PortfolioSolver
+    {
+    private:
+        using Self = PortfolioSolver;
+        using This = Self &;
+
+    public:
+        struct Entry
+        {
+            std::string name;
+            SudokuSolver::Strategy strategy;
+
+            /**
+             * Whether to restart the search after a node budget (growing on each
+             * restart) is spent. Only makes sense for shuffling strategies, and the
+             * shuffle seed changes on each restart.
+             */
+            bool restarts;
+        };
+
+        struct Result
+        {
+            SudokuSolver::Table table;
+
+            /**
+             * Name of the entry that won the race.
+             */
+            std::string winner;
+
+            /**
+             * Number of nodes visited by all entries, among all their restarts, and not
+             * only by the winner.
+             */
+            std::size_t nodesCount;
+        };
+
+        PortfolioSolver() = delete;
+
+        /**
+         * Throws if no entry is given.
+         */
+        PortfolioSolver(SudokuSolver::Table, std::vector<Entry> = Self::getDefaultEntries());
+
+        static std::vector<Entry> getDefaultEntries();
+
+        /**
+         * Throws the same way SudokuSolver::solve() does.
+         */
+        Result solve();
+
+    protected:
+        /**
+         * Number of nodes each solver visits, before checking whether it has lost.
+         */
+        constexpr static std::size_t stepNodesCount = 1024;
+
+        constexpr static std::size_t initialRestartNodesCount = 1024;
+
+        SudokuSolver::Table table;
+        std::vector<Entry> entries;
+
+        std::atomic<bool> finished = false;
+        std::atomic<std::size_t> nodesCount = 0;
+
+        Result result;
+        std::exception_ptr exception;
+
+        void race(const Entry &);
+        void finish(const Entry &, const SudokuSolver &);
+        void finish(std::exception_ptr);
+    };
+}
+
+#endif // ZUDOKU_PORTFOLIO_SOLVER_HPP
@@ -1,7 +1,9 @@
 #ifndef ZUDOKU_STACK_HPP
 #define ZUDOKU_STACK_HPP
 
+#include <iterator>
 #include <stack>
+#include <utility>
 
 namespace Zudoku
 {
@@ -27,6 +29,31 @@ namespace Zudoku
              */
             return result;
         }
+
+        /**
+         * Swaps the top element with the one having the minimum key, as returned by the
+         * given function. The order of other elements might change.
+         */
+        template<typename KeyGetter>
+        void swap_min_to_top(KeyGetter getKey)
+        {
+            if (this->empty()) {
+                return;
+            }
+
+            auto min = this->c.rbegin();
+            auto minKey = getKey(*min);
+
+            for (auto it = std::next(min); it != this->c.rend(); ++it) {
+                auto key = getKey(*it);
+                if (key < minKey) {
+                    min = it;
+                    minKey = std::move(key);
+                }
+            }
+
+            std::swap(*min, *this->c.rbegin());
+        }
     };
 }
 
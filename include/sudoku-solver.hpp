@@ -2,11 +2,13 @@
 #define ZUDOKU_SUDOKU_SOLVER_HPP
 
 #include <array>
+#include <random>
 #include <stdexcept>
 #include <string>
 
 #include "flossy.h"
 #include "stack.hpp"
+#include "sudoku-tables.hpp"
 
 namespace Zudoku
 {
@@ -118,6 +120,59 @@ namespace Zudoku
          */
         using Table = std::array<std::array<CellValue, 9>, 9>;
 
+        /**
+         * Thrown when the table is valid, but there is no way to fill it.
+         */
+        class NoSolutionError: public std::invalid_argument
+        {
+        public:
+            NoSolutionError(): std::invalid_argument("The table has no solution")
+            {}
+        };
+
+        /**
+         * Where the search is. Unprepared is before prepare() is called. Searching means
+         * there are cells still to be tried. Solved means the table is filled correctly
+         * and completely, and Exhausted means there is no (more) solution to be found.
+         */
+        enum class State
+        {
+            Unprepared,
+            Searching,
+            Solved,
+            Exhausted,
+        };
+
+        /**
+         * How the search is guided. None of them affects the correctness of the result,
+         * but each one has inputs on which it is much faster or slower than the others.
+         */
+        struct Strategy
+        {
+            enum class CellOrder
+            {
+                /**
+                 * Empty cells are sorted once, by the count of their possibilities at the
+                 * very beginning.
+                 */
+                Static,
+
+                /**
+                 * Each time a new cell is to be filled, the one with the least currently
+                 * valid possibilities is chosen.
+                 */
+                MinimumRemainingValues,
+            };
+
+            CellOrder cellOrder;
+
+            /**
+             * When non-zero, possibilities of each cell are tried in a random order,
+             * generated using this seed.
+             */
+            unsigned int shuffleSeed;
+        };
+
         SudokuSolver() = delete;
 
         /**
@@ -126,9 +181,39 @@ namespace Zudoku
          */
         SudokuSolver(Table);
         SudokuSolver(Table &&);
+        SudokuSolver(Table, Strategy);
 
+        /**
+         * Solves the table at once. Throws NoSolutionError if the table has no solution.
+         */
         This solve();
 
+        /**
+         * Validates the table and gathers the data needed for the search, without
+         * actually searching. Done implicitly by solve(). Must be called only once; if it
+         * throws, the state becomes Exhausted.
+         */
+        This prepare();
+
+        /**
+         * Advances the search by visiting at most the given number of nodes (i.e. tries of
+         * a cell), so the caller could do something else in between, or simply stop
+         * calling it to abandon the search. Every piece of the search state is kept in
+         * the object.
+         *
+         * Calling it in the Solved state discards the current solution and continues
+         * searching for the next one, which makes it possible to enumerate solutions one
+         * by one.
+         */
+        State step(std::size_t maxNodesCount);
+
+        State getState() const noexcept;
+
+        /**
+         * Number of nodes visited so far, among all steps.
+         */
+        std::size_t getNodesCount() const noexcept;
+
         Table getTable() const;
 
     protected:
@@ -178,7 +263,7 @@ namespace Zudoku
         {
             using Possibilities = stack<CellValue>;
 
-            const CellIndex index;
+            CellIndex index;
 
             struct {
                 Possibilities tried, untried;
@@ -197,10 +282,9 @@ namespace Zudoku
          * valueExist takes care of existence of values in all blocks one by one. Every
          * block is indexed, and a specific one could be catched using its index.
          *
-         * The function (i.e. indexGetter) specified in order to find block index based on
-         * a cell index. For example, the cell (0, 0) is in row 0, column 0, and square 0.
-         * Note that, squares start from top-left and ends in bottom-right, iterating
-         * right-to-left and then up-to-down.
+         * The block type (i.e. blockType) is used to find block index based on a cell
+         * index, by looking it up in SudokuTables::blockIndices. For example, the cell
+         * (0, 0) is in row 0, column 0, and square 0.
          *
          * The sole definition purpose of the name property is for exception message
          * generation.
@@ -209,7 +293,7 @@ namespace Zudoku
         {
             const std::string name;
             std::array<ValueExistence, 9> valueExist;
-            CellLinearIndex (&indexGetter)(const CellIndex &);
+            SudokuTables::BlockType blockType;
         };
 
         struct {
@@ -220,22 +304,18 @@ namespace Zudoku
          * By using an array instead of a struct, iteration will be just easier.
          */
         std::array<BlockSetData, 3> blockSetDataArray = {{
-            {"row", {0}, Self::getRowIndex},
-            {"column", {0}, Self::getColumnIndex},
-            {"square", {0}, Self::getSquareIndex},
+            {"row", {0}, SudokuTables::Row},
+            {"column", {0}, SudokuTables::Column},
+            {"square", {0}, SudokuTables::Square},
         }};
 
-        constexpr static CellLinearIndex getRowIndex(const CellIndex &index)
-        {
-            return index.first;
-        }
-        constexpr static CellLinearIndex getColumnIndex(const CellIndex &index)
-        {
-            return index.second;
-        }
-        constexpr static CellLinearIndex getSquareIndex(const CellIndex &index)
-        {
-            return index.first / 3 * 3 + index.second / 3;
+        constexpr static unsigned int getBlockIndex(
+            const BlockSetData &blockSetData,
+            const CellIndex &index
+        ) {
+            return SudokuTables::blockIndices[
+                SudokuTables::getCellPosition(index.first, index.second)
+            ][blockSetData.blockType];
         }
 
         constexpr static bool doesValueExistInBlock(
@@ -243,14 +323,14 @@ namespace Zudoku
             const CellIndex &index,
             const CellValue &value
         ) {
-            return blockSetData.valueExist[blockSetData.indexGetter(index)][value];
+            return blockSetData.valueExist[Self::getBlockIndex(blockSetData, index)][value];
         }
         constexpr static bool &doesValueExistInBlock(
             BlockSetData &blockSetData,
             const CellIndex &index,
             const CellValue &value
         ) {
-            return blockSetData.valueExist[blockSetData.indexGetter(index)][value];
+            return blockSetData.valueExist[Self::getBlockIndex(blockSetData, index)][value];
         }
 
         constexpr bool doesValueExistInAnySharedBlocks(
@@ -272,7 +352,8 @@ namespace Zudoku
         This makeEmptyCellsPossibilities();
         This sortEmptyCellsByPossibilitiesCount();
 
-        This tryEmptyCellsPossibilities();
+        This tryEmptyCellsPossibilities(std::size_t maxNodesCount);
+        This bringMostConstrainedEmptyCellToTop();
 
         This replaceCell(const CellIndex &, const CellValue &);
         This clearCell(const CellIndex &);
@@ -281,6 +362,12 @@ namespace Zudoku
     private:
         Table table;
 
+        Strategy strategy = {Strategy::CellOrder::Static, 0};
+        std::minstd_rand randomEngine;
+
+        State state = State::Unprepared;
+        std::size_t nodesCount = 0;
+
         struct NextCorrectPossibility
         {
             bool found;
@@ -288,6 +375,8 @@ namespace Zudoku
         };
 
         NextCorrectPossibility findNextCorrectPossibility(EmptyCellData &) const;
+
+        unsigned int countValidPossibilities(const CellIndex &) const;
     };
 }
 
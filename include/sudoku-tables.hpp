@@ -0,0 +1,125 @@
+#ifndef ZUDOKU_SUDOKU_TABLES_HPP
+#define ZUDOKU_SUDOKU_TABLES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Zudoku
+{
+    /**
+     * Lookup tables of the Sudoku table structure, generated at compile time.
+     *
+     * Cells are addressed by their position, i.e. row * 9 + column. Squares start from
+     * top-left and end in bottom-right, iterating left-to-right and then up-to-down.
+     */
+    class SudokuTables // static
+    {
+    public:
+        SudokuTables() = delete;
+
+        /**
+         * Types of blocks, also used as indices of BlockIndices rows.
+         */
+        enum BlockType: std::size_t
+        {
+            Row,
+            Column,
+            Square,
+        };
+
+        constexpr static std::size_t cellsCount = 81;
+        constexpr static std::size_t blockTypesCount = 3;
+
+        /**
+         * Peers of a cell are the cells sharing at least one block with it, excluding
+         * the cell itself.
+         */
+        constexpr static std::size_t peersCount = 20;
+
+        using BlockIndices = std::array<std::array<std::uint8_t, blockTypesCount>, cellsCount>;
+        using Peers = std::array<std::array<std::uint8_t, peersCount>, cellsCount>;
+
+        /**
+         * Index of the row, the column and the square of each cell, in this order.
+         */
+        static const BlockIndices blockIndices;
+
+        /**
+         * Positions of the peers of each cell. Only used at compile time for now (by
+         * CompileTimeSolver), as the runtime solver works with blocks.
+         */
+        static const Peers peers;
+
+        constexpr static std::size_t getCellPosition(std::size_t row, std::size_t column)
+        {
+            return row * 9 + column;
+        }
+
+    protected:
+        constexpr static BlockIndices makeBlockIndices() noexcept
+        {
+            BlockIndices result{};
+
+            for (std::size_t i = 0; i < 9; i++) {
+                for (std::size_t j = 0; j < 9; j++) {
+                    std::array<std::uint8_t, blockTypesCount> &indices =
+                        result[getCellPosition(i, j)];
+
+                    indices[Row] = i;
+                    indices[Column] = j;
+                    indices[Square] = i / 3 * 3 + j / 3;
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * Peers are generated block by block, rather than by comparing every pair of
+         * cells, to keep constant evaluation cheap: The other cells of the row, the other
+         * cells of the column, and then the cells of the square in neither of them.
+         */
+        constexpr static Peers makePeers() noexcept
+        {
+            Peers result{};
+
+            for (std::size_t i = 0; i < 9; i++) {
+                for (std::size_t j = 0; j < 9; j++) {
+                    std::array<std::uint8_t, peersCount> &cellPeers =
+                        result[getCellPosition(i, j)];
+                    std::size_t count = 0;
+
+                    for (std::size_t k = 0; k < 9; k++) {
+                        if (k != j) {
+                            cellPeers[count++] = getCellPosition(i, k);
+                        }
+                        if (k != i) {
+                            cellPeers[count++] = getCellPosition(k, j);
+                        }
+                    }
+
+                    for (std::size_t k = i / 3 * 3; k < i / 3 * 3 + 3; k++) {
+                        for (std::size_t l = j / 3 * 3; l < j / 3 * 3 + 3; l++) {
+                            if (k != i && l != j) {
+                                cellPeers[count++] = getCellPosition(k, l);
+                            }
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+    };
+
+    inline constexpr SudokuTables::BlockIndices SudokuTables::blockIndices =
+        SudokuTables::makeBlockIndices();
+
+    inline constexpr SudokuTables::Peers SudokuTables::peers = SudokuTables::makePeers();
+
+    static_assert(SudokuTables::blockIndices[80][SudokuTables::Square] == 8);
+    static_assert(SudokuTables::peers[0][19] == 20);
+}
+
+#endif // ZUDOKU_SUDOKU_TABLES_HPP
@@ -0,0 +1,81 @@
+#ifndef ZUDOKU_VALIDATOR_APP_HPP
+#define ZUDOKU_VALIDATOR_APP_HPP
+
+#include <string>
+#include <vector>
+
+#include "app.hpp"
+#include "grid-validator.hpp"
+
+namespace Zudoku
+{
+    /**
+     * The non-interactive app for checking (already solved, or partial) tables in CSV
+     * files, without solving them.
+     */
+    class ValidatorApp: protected App
+    {
+    private:
+        using Self = ValidatorApp;
+        using This = Self &;
+
+    public:
+        struct Options
+        {
+            std::vector<std::string> inputCsvFilePaths;
+
+            bool requireComplete = false;
+
+            /**
+             * Path of the CSV file of the puzzle the tables should conform to. Empty
+             * means no puzzle.
+             */
+            std::string puzzleCsvFilePath;
+        };
+
+        ValidatorApp() = delete;
+
+        ValidatorApp(Options);
+
+        /**
+         * Parses command-line arguments, in the form of:
+         *
+         *     --validate [--complete] [--puzzle FILE] FILE...
+         */
+        static Options parseArguments(int argc, const char *const argv[]);
+
+        This run();
+
+        /**
+         * Whether every file checked so far was readable and valid.
+         */
+        bool hasAllPassed() const noexcept;
+
+    protected:
+        /**
+         * Number of grids loaded into memory, before being checked all at once, using
+         * the bulk check of GridValidator.
+         */
+        constexpr static std::size_t batchSize = 1024;
+
+        struct Entry
+        {
+            std::string inputCsvFilePath;
+            GridValidator::Grid grid;
+            std::string error;
+        };
+
+        Options options;
+
+        struct {
+            std::size_t valid = 0, invalid = 0, unreadable = 0;
+        } filesCount;
+
+        Entry readEntry(const std::string &);
+        GridValidator::Grid readGrid(const std::string &);
+
+        This validateBatch(const std::vector<Entry> &, const GridValidator::Options &);
+    };
+}
+
+#endif // ZUDOKU_VALIDATOR_APP_HPP
@@ -0,0 +1,438 @@
+#include "batch-app.hpp"
+
+#include <csignal>
+#include <limits>
+#include <thread>
+
+#include "chop.hpp"
+#include "metrics.hpp"
+#include "portfolio-solver.hpp"
+
+using namespace Zudoku;
+using namespace MAChitgarha::Chop;
+
+using Clock = std::chrono::steady_clock;
+
+std::atomic<bool> BatchApp::metricsDumpRequested = false;
+
+BatchApp::BatchApp(Options options):
+    options(std::move(options))
+{
+}
+
+BatchApp::Options BatchApp::parseArguments(int argc, const char *const argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+
+        if (arg == "--batch") {
+            continue;
+        }
+        if (arg == "--batch-size") {
+            if (++i == argc) {
+                throw std::invalid_argument("Expected a number after --batch-size");
+            }
+            options.batchSize = Self::parseBatchSize(argv[i]);
+            continue;
+        }
+
+        if (arg == "--portfolio") {
+            options.portfolio = true;
+            continue;
+        }
+        if (arg == "--check-uniqueness") {
+            options.checkUniqueness = true;
+            continue;
+        }
+        if (arg == "--metrics") {
+            if (++i == argc) {
+                throw std::invalid_argument("Expected a file path after --metrics");
+            }
+            options.metricsFilePath = argv[i];
+            continue;
+        }
+
+        if (arg.rfind("--", 0) == 0) {
+            throw std::invalid_argument(flossy::format("Unknown option {}", arg));
+        }
+
+        options.inputCsvFilePaths.push_back(arg);
+    }
+
+    if (options.inputCsvFilePaths.empty()) {
+        throw std::invalid_argument("Expected at least one input CSV file path");
+    }
+
+    return options;
+}
+
+std::size_t BatchApp::parseBatchSize(const std::string &arg)
+{
+    const std::invalid_argument error{"Batch size must be a positive number"};
+
+    // std::stoul() accepts signs and trailing garbage, and wraps negative numbers
+    if (arg.empty() || arg.find_first_not_of("0123456789") != std::string::npos) {
+        throw error;
+    }
+
+    std::size_t batchSize = 0;
+    try {
+        batchSize = std::stoul(arg);
+    } catch (std::out_of_range &) {
+        throw error;
+    }
+
+    if (batchSize == 0) {
+        throw error;
+    }
+
+    return batchSize;
+}
+
+BatchApp::This BatchApp::run()
+{
+    const Clock::time_point startTime = Clock::now();
+
+    std::thread metricsDumper;
+    if (!this->options.metricsFilePath.empty()) {
+#ifdef SIGUSR1
+        std::signal(SIGUSR1, &Self::requestMetricsDump);
+#endif
+        metricsDumper = std::thread{&Self::metricsDumpStage, this};
+    }
+
+    std::thread
+        reader{&Self::readStage, this},
+        solver{&Self::solveStage, this};
+
+    // The main thread is the last stage itself
+    this->writeStage();
+
+    reader.join();
+    solver.join();
+
+    const Clock::time_point endTime = Clock::now();
+
+    if (metricsDumper.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{this->finishedMutex};
+            this->finished = true;
+        }
+        this->finishedCondition.notify_one();
+
+        metricsDumper.join();
+        this->dumpMetrics();
+    }
+
+    return this->reportStats(endTime - startTime);
+}
+
+void BatchApp::readStage()
+{
+    StageStats &stats = this->stageStats.reader;
+    Batch batch;
+
+    for (const std::string &path: this->options.inputCsvFilePaths) {
+        const Clock::time_point busyStartTime = Clock::now();
+
+        batch.push_back(this->readJob(path));
+        stats.jobsCount++;
+
+        stats.busyTime += Clock::now() - busyStartTime;
+
+        if (batch.size() == this->options.batchSize) {
+            const Clock::time_point waitStartTime = Clock::now();
+
+            this->readQueue.push(std::move(batch));
+            batch = {};
+
+            stats.waitTime += Clock::now() - waitStartTime;
+        }
+    }
+
+    if (!batch.empty()) {
+        this->readQueue.push(std::move(batch));
+    }
+    this->readQueue.close();
+}
+
+void BatchApp::solveStage()
+{
+    StageStats &stats = this->stageStats.solver;
+    Batch batch;
+
+    do {
+        Clock::time_point waitStartTime = Clock::now();
+
+        if (!this->readQueue.pop(batch)) {
+            break;
+        }
+
+        const Clock::time_point busyStartTime = Clock::now();
+        stats.waitTime += busyStartTime - waitStartTime;
+
+        for (Job &job: batch) {
+            this->solveJob(job);
+            stats.jobsCount++;
+        }
+
+        waitStartTime = Clock::now();
+        stats.busyTime += waitStartTime - busyStartTime;
+
+        this->solveQueue.push(std::move(batch));
+        batch = {};
+
+        stats.waitTime += Clock::now() - waitStartTime;
+    } while (true);
+
+    this->solveQueue.close();
+}
+
+void BatchApp::writeStage()
+{
+    StageStats &stats = this->stageStats.writer;
+    Batch batch;
+
+    do {
+        const Clock::time_point waitStartTime = Clock::now();
+
+        if (!this->solveQueue.pop(batch)) {
+            break;
+        }
+
+        const Clock::time_point busyStartTime = Clock::now();
+        stats.waitTime += busyStartTime - waitStartTime;
+
+        for (Job &job: batch) {
+            this->writeJob(job);
+            stats.jobsCount++;
+        }
+
+        stats.busyTime += Clock::now() - busyStartTime;
+    } while (true);
+}
+
+void BatchApp::metricsDumpStage()
+{
+    std::unique_lock<std::mutex> lock{this->finishedMutex};
+
+    while (!this->finishedCondition.wait_for(
+        lock, Self::metricsDumpPollInterval, [this] { return this->finished; }
+    )) {
+        if (Self::metricsDumpRequested.exchange(false)) {
+            // Not blocking the main thread from finishing while dumping
+            lock.unlock();
+            this->dumpMetrics();
+            lock.lock();
+        }
+    }
+}
+
+BatchApp::Job BatchApp::readJob(const std::string &inputCsvFilePath)
+{
+    Job job{inputCsvFilePath, {}, {}, {}, false};
+
+    try {
+        job.csvData = this->readCsvFileData(inputCsvFilePath);
+        job.table = this->prepareTable(job.csvData);
+    } catch (std::ios_base::failure &) {
+        job.error = "Could not read the file";
+    } catch (std::exception &e) {
+        job.error = e.what();
+        job.isDataInvalid = true;
+    }
+
+    return job;
+}
+
+BatchApp::This BatchApp::solveJob(Job &job)
+{
+    const Metrics::Engine engine = this->options.portfolio ?
+        Metrics::Engine::Portfolio : Metrics::Engine::Solver;
+
+    if (!job.error.empty()) {
+        // There was nothing to solve, so there is no latency or nodes to record either
+        if (job.isDataInvalid) {
+            Metrics::recordOutcome(engine, Metrics::Outcome::Invalid);
+        }
+        return *this;
+    }
+
+    const Clock::time_point startTime = Clock::now();
+    constexpr std::size_t unlimited = std::numeric_limits<std::size_t>::max();
+
+    Metrics::Outcome outcome = Metrics::Outcome::Solved;
+    std::size_t nodesCount = 0;
+
+    try {
+        if (this->options.portfolio) {
+            PortfolioSolver::Result result = PortfolioSolver{job.table}.solve();
+
+            job.table = result.table;
+            nodesCount = result.nodesCount;
+            this->portfolioWinsCount[result.winner]++;
+        } else {
+            SudokuSolver solver{job.table};
+
+            SudokuSolver::State state = solver.prepare().getState();
+            if (state == SudokuSolver::State::Searching) {
+                state = solver.step(unlimited);
+            }
+
+            nodesCount = solver.getNodesCount();
+
+            if (state == SudokuSolver::State::Exhausted) {
+                throw SudokuSolver::NoSolutionError{};
+            }
+            job.table = solver.getTable();
+
+            if (this->options.checkUniqueness) {
+                if (solver.step(unlimited) == SudokuSolver::State::Solved) {
+                    outcome = Metrics::Outcome::MultipleSolutions;
+                }
+                nodesCount = solver.getNodesCount();
+            }
+        }
+    } catch (SudokuSolver::NoSolutionError &e) {
+        outcome = Metrics::Outcome::NoSolution;
+        job.error = e.what();
+    } catch (std::exception &e) {
+        outcome = Metrics::Outcome::Invalid;
+        job.error = e.what();
+    }
+
+    Metrics::recordSolve(
+        engine,
+        outcome,
+        Clock::now() - startTime,
+        nodesCount
+    );
+
+    return *this;
+}
+
+BatchApp::This BatchApp::writeJob(Job &job)
+{
+    if (job.error.empty()) {
+        try {
+            this->saveSolvedTableToCsvFile(
+                job.csvData, Self::getOutputCsvFilePath(job.inputCsvFilePath), job.table
+            );
+        } catch (std::ios_base::failure &) {
+            job.error = "Could not save to the output file";
+        }
+    }
+
+    if (job.error.empty()) {
+        this->jobsCount.succeeded++;
+    } else {
+        this->jobsCount.failed++;
+        printLine("Error: ", job.inputCsvFilePath, ": ", job.error);
+    }
+
+    return *this;
+}
+
+std::string BatchApp::getOutputCsvFilePath(const std::string &inputCsvFilePath)
+{
+    const std::string extension = ".csv";
+    std::string path = inputCsvFilePath;
+
+    if (
+        path.size() >= extension.size() &&
+        path.compare(path.size() - extension.size(), extension.size(), extension) == 0
+    ) {
+        path.erase(path.size() - extension.size());
+    }
+
+    // Following the naming of the available examples
+    return path + "-solved" + extension;
+}
+
+void BatchApp::requestMetricsDump(int)
+{
+    Self::metricsDumpRequested = true;
+}
+
+BatchApp::This BatchApp::dumpMetrics()
+{
+    try {
+        Metrics::saveToFile(this->options.metricsFilePath);
+    } catch (std::ios_base::failure &) {
+        printLine("Error: Could not save metrics to ", this->options.metricsFilePath);
+    }
+
+    return *this;
+}
+
+BatchApp::This BatchApp::reportStats(Clock::duration totalTime)
+{
+    using std::chrono::duration_cast;
+    using Milliseconds = std::chrono::milliseconds;
+
+    printLine();
+    printLine(flossy::format(
+        "Processed {} file(s) in {}ms: {} succeeded, {} failed.",
+        this->options.inputCsvFilePaths.size(),
+        duration_cast<Milliseconds>(totalTime).count(),
+        this->jobsCount.succeeded,
+        this->jobsCount.failed
+    ));
+
+    const StageStats *bottleneck = nullptr;
+
+    printLine();
+    for (const StageStats *stats: {
+        &this->stageStats.reader, &this->stageStats.solver, &this->stageStats.writer
+    }) {
+        const auto busyMicroseconds =
+            duration_cast<std::chrono::microseconds>(stats->busyTime).count();
+
+        printLine(flossy::format(
+            "{} stage: {} file(s), busy {}ms, waiting {}ms, {} file(s)/s",
+            stats->name,
+            stats->jobsCount,
+            duration_cast<Milliseconds>(stats->busyTime).count(),
+            duration_cast<Milliseconds>(stats->waitTime).count(),
+            busyMicroseconds == 0 ? 0 : stats->jobsCount * 1'000'000 / busyMicroseconds
+        ));
+
+        if (bottleneck == nullptr || stats->busyTime > bottleneck->busyTime) {
+            bottleneck = stats;
+        }
+    }
+
+    printLine();
+    for (const auto &[name, queue]: {
+        std::pair<std::string, const Queue *>{"read", &this->readQueue},
+        std::pair<std::string, const Queue *>{"solve", &this->solveQueue},
+    }) {
+        const Queue::OccupancyStats &occupancy = queue->getOccupancyStats();
+
+        printLine(flossy::format(
+            "{} queue occupancy: average {}%, maximum {} of {} batches",
+            name,
+            static_cast<unsigned int>(occupancy.average() * 100 / Queue::capacity()),
+            occupancy.maximum,
+            Queue::capacity()
+        ));
+    }
+
+    if (!this->portfolioWinsCount.empty()) {
+        printLine();
+        for (const auto &[name, winsCount]: this->portfolioWinsCount) {
+            printLine(flossy::format("{} strategy won {} time(s)", name, winsCount));
+        }
+    }
+
+    printLine();
+    printLine(flossy::format(
+        "Bottleneck: {} stage ({}-bound).",
+        bottleneck->name,
+        bottleneck == &this->stageStats.solver ? "CPU" : "I/O"
+    ));
+
+    return *this;
+}
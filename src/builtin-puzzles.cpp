@@ -0,0 +1,30 @@
+#include "builtin-puzzles.hpp"
+
+using namespace Zudoku;
+
+/*
+ * Solving and verifying the built-in puzzles while building. If any of them fails, the
+ * build fails as well. Nothing here ends up in the binary.
+ *
+ * Each puzzle has an assertion of its own, so each one gets its own compiler budget for
+ * constant evaluation.
+ */
+static_assert(BuiltinPuzzles::verify(0), "Built-in puzzle 1 has not been solved correctly");
+static_assert(BuiltinPuzzles::verify(1), "Built-in puzzle 2 has not been solved correctly");
+static_assert(BuiltinPuzzles::verify(2), "Built-in puzzle 3 has not been solved correctly");
+static_assert(BuiltinPuzzles::examples.size() == 3, "Not all built-in puzzles are verified");
+
+static_assert(
+    !CompileTimeSolver::solve(CompileTimeSolver::parse(
+        ".12345678"
+        "9........"
+        "........."
+        "........."
+        "........."
+        "........."
+        "........."
+        "........."
+        "........."
+    )).solved,
+    "A puzzle with no solution has been solved"
+);
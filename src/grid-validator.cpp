@@ -0,0 +1,278 @@
+#include "grid-validator.hpp"
+
+#include <algorithm>
+
+using namespace Zudoku;
+
+using Self = GridValidator;
+using Kind = GridValidator::Conflict::Kind;
+
+namespace
+{
+    /**
+     * The bit of a cell value, as described in GridValidator::checkGroup(). The same as
+     * 1 << min(value, 10), but as a product of one factor per bit of the clamped value,
+     * because multiplications of 16-bit lanes are vectorized on every target (e.g. SSE2),
+     * unlike variable shifts and table lookups.
+     */
+    constexpr std::uint16_t getValueBit(std::uint16_t value) noexcept
+    {
+        const std::uint16_t clamped = value > 10 ? 10 : value;
+
+        return (1 + (clamped & 1)) *
+            (1 + 3 * ((clamped >> 1) & 1)) *
+            (1 + 15 * ((clamped >> 2) & 1)) *
+            (1 + 255 * ((clamped >> 3) & 1));
+    }
+
+    static_assert(getValueBit(0) == 1 && getValueBit(9) == 1 << 9);
+    static_assert(getValueBit(10) == 1 << 10 && getValueBit(255) == 1 << 10);
+}
+
+bool GridValidator::isValid(const Grid &grid, const Options &options) noexcept
+{
+    // No need for any other lane
+    bool result = false;
+    Self::checkGroup<1>(&grid, 1, &result, options);
+
+    return result;
+}
+
+void GridValidator::isValid(
+    const Grid *grids,
+    std::size_t count,
+    bool *results,
+    const Options &options
+) noexcept {
+    for (std::size_t first = 0; first < count; first += Self::lanesCount) {
+        Self::checkGroup<Self::lanesCount>(
+            grids + first,
+            std::min(count - first, Self::lanesCount),
+            results + first,
+            options
+        );
+    }
+}
+
+template<std::size_t LanesCount>
+void GridValidator::checkGroup(
+    const Grid *grids,
+    std::size_t count,
+    bool *results,
+    const Options &options
+) noexcept {
+    using Lanes = std::array<std::uint16_t, LanesCount>;
+
+    /*
+     * Each value is mapped to one bit: Bit 0 for empty cells, bits 1 to 9 for valid
+     * values, and bit 10 for all out of range values. In a block, as long as no bit is
+     * set twice, the sum of bits equals their bitwise-or. So, a block has a duplicate if
+     * and only if the two differ.
+     *
+     * Grids are transposed first, so each cell becomes a vector with one lane per grid.
+     * Every loop below then runs over all lanes, with a fixed count, no branch and no
+     * lookup, which lets the compiler vectorize them even at -O2. Unused lanes are left
+     * empty, and their results are dropped.
+     */
+    std::array<std::array<std::uint8_t, LanesCount>, SudokuTables::cellsCount> cells{};
+
+    for (std::size_t cell = 0; cell < SudokuTables::cellsCount; cell++) {
+        for (std::size_t lane = 0; lane < count; lane++) {
+            cells[cell][lane] = grids[lane][cell / 9][cell % 9];
+        }
+    }
+
+    constexpr std::uint16_t valuesMask = 0b01111111110;
+
+    Lanes duplicates{}, allBits{}, puzzleMismatches{};
+    std::array<Lanes, 9> columnsSum{}, columnsOr{};
+
+    // Each band is three rows, holding three squares
+    for (std::size_t band = 0; band < 3; band++) {
+        std::array<Lanes, 9> bandSum{}, bandOr{};
+
+        for (std::size_t i = band * 3; i < band * 3 + 3; i++) {
+            Lanes rowSum{}, rowOr{};
+
+            for (std::size_t j = 0; j < 9; j++) {
+                const std::array<std::uint8_t, LanesCount> &values =
+                    cells[SudokuTables::getCellPosition(i, j)];
+
+                for (std::size_t lane = 0; lane < LanesCount; lane++) {
+                    const std::uint16_t bit = getValueBit(values[lane]);
+                    const std::uint16_t valueBit = bit & valuesMask;
+
+                    rowSum[lane] += valueBit;
+                    rowOr[lane] |= valueBit;
+                    bandSum[j][lane] += valueBit;
+                    bandOr[j][lane] |= valueBit;
+                    allBits[lane] |= bit;
+                }
+            }
+
+            for (std::size_t lane = 0; lane < LanesCount; lane++) {
+                duplicates[lane] |= rowSum[lane] ^ rowOr[lane];
+            }
+        }
+
+        for (std::size_t j = 0; j < 9; j += 3) {
+            for (std::size_t lane = 0; lane < LanesCount; lane++) {
+                duplicates[lane] |=
+                    (bandSum[j][lane] + bandSum[j + 1][lane] + bandSum[j + 2][lane]) ^
+                    (bandOr[j][lane] | bandOr[j + 1][lane] | bandOr[j + 2][lane]);
+            }
+        }
+
+        for (std::size_t j = 0; j < 9; j++) {
+            for (std::size_t lane = 0; lane < LanesCount; lane++) {
+                columnsSum[j][lane] += bandSum[j][lane];
+                columnsOr[j][lane] |= bandOr[j][lane];
+            }
+        }
+    }
+
+    for (std::size_t j = 0; j < 9; j++) {
+        for (std::size_t lane = 0; lane < LanesCount; lane++) {
+            duplicates[lane] |= columnsSum[j][lane] ^ columnsOr[j][lane];
+        }
+    }
+
+    if (options.puzzle != nullptr) {
+        for (std::size_t cell = 0; cell < SudokuTables::cellsCount; cell++) {
+            const std::uint16_t puzzleValue = (*options.puzzle)[cell / 9][cell % 9];
+
+            if (puzzleValue == 0) {
+                continue;
+            }
+            for (std::size_t lane = 0; lane < LanesCount; lane++) {
+                puzzleMismatches[lane] |= puzzleValue != cells[cell][lane];
+            }
+        }
+    }
+
+    const std::uint16_t invalidBits = (1 << 10) | (options.requireComplete ? 1 : 0);
+
+    for (std::size_t lane = 0; lane < count; lane++) {
+        results[lane] = (
+            duplicates[lane] | puzzleMismatches[lane] | (allBits[lane] & invalidBits)
+        ) == 0;
+    }
+}
+
+std::vector<GridValidator::Conflict> GridValidator::findConflicts(
+    const Grid &grid,
+    const Options &options
+) {
+    std::vector<Conflict> conflicts;
+
+    for (SudokuSolver::CellLinearIndex i: SudokuSolver::CellLinearIndex::forEach()) {
+        for (SudokuSolver::CellLinearIndex j: SudokuSolver::CellLinearIndex::forEach()) {
+            const SudokuSolver::CellIndex cell = {i, j};
+            const unsigned int value = grid[i][j];
+
+            if (value > 9) {
+                conflicts.push_back({Kind::OutOfRange, cell, cell, value});
+            }
+            if (value == 0 && options.requireComplete) {
+                conflicts.push_back({Kind::Empty, cell, cell, value});
+            }
+
+            if (options.puzzle != nullptr) {
+                const unsigned int puzzleValue = (*options.puzzle)[i][j];
+
+                if (puzzleValue != 0 && puzzleValue != value) {
+                    conflicts.push_back({Kind::PuzzleMismatch, cell, cell, value});
+                }
+            }
+        }
+    }
+
+    for (Kind kind: {Kind::DuplicateInRow, Kind::DuplicateInColumn, Kind::DuplicateInSquare}) {
+        for (unsigned int block = 0; block < 9; block++) {
+            // Position of the first cell seen for each value, plus one
+            std::array<unsigned int, 10> firstPositions{};
+
+            for (unsigned int position = 0; position < 9; position++) {
+                const SudokuSolver::CellIndex cell =
+                    Self::getCellIndexInBlock(kind, block, position);
+                const unsigned int value = grid[cell.first][cell.second];
+
+                if (value == 0 || value > 9) {
+                    continue;
+                }
+
+                if (firstPositions[value] == 0) {
+                    firstPositions[value] = position + 1;
+                } else {
+                    conflicts.push_back({
+                        kind,
+                        cell,
+                        Self::getCellIndexInBlock(kind, block, firstPositions[value] - 1),
+                        value
+                    });
+                }
+            }
+        }
+    }
+
+    return conflicts;
+}
+
+std::string GridValidator::describeConflict(const Conflict &conflict)
+{
+    const unsigned int
+        row = static_cast<unsigned int>(conflict.cell.first) + 1,
+        column = static_cast<unsigned int>(conflict.cell.second) + 1;
+
+    switch (conflict.kind) {
+        case Kind::OutOfRange:
+            return flossy::format(
+                "Value {} at ({}, {}) is out of the range of 0 to 9",
+                conflict.value, row, column
+            );
+
+        case Kind::Empty:
+            return flossy::format("Cell ({}, {}) is empty", row, column);
+
+        case Kind::PuzzleMismatch:
+            return flossy::format(
+                "Value {} at ({}, {}) does not match the puzzle",
+                conflict.value, row, column
+            );
+
+        default:
+            return flossy::format(
+                "Value {} is repeated in {} {}, at ({}, {}) and ({}, {})",
+                conflict.value,
+                conflict.kind == Kind::DuplicateInRow ? "row" :
+                    conflict.kind == Kind::DuplicateInColumn ? "column" : "square",
+                conflict.kind == Kind::DuplicateInRow ? row :
+                    conflict.kind == Kind::DuplicateInColumn ? column :
+                    (row - 1) / 3 * 3 + (column - 1) / 3 + 1,
+                static_cast<unsigned int>(conflict.otherCell.first) + 1,
+                static_cast<unsigned int>(conflict.otherCell.second) + 1,
+                row,
+                column
+            );
+    }
+}
+
+SudokuSolver::CellIndex GridValidator::getCellIndexInBlock(
+    Conflict::Kind kind,
+    unsigned int blockIndex,
+    unsigned int positionInBlock
+) noexcept {
+    switch (kind) {
+        case Kind::DuplicateInRow:
+            return {blockIndex, positionInBlock};
+
+        case Kind::DuplicateInColumn:
+            return {positionInBlock, blockIndex};
+
+        default:
+            return {
+                blockIndex / 3 * 3 + positionInBlock / 3,
+                blockIndex % 3 * 3 + positionInBlock % 3
+            };
+    }
+}
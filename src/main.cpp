@@ -1,18 +1,39 @@
 #include "app.hpp"
+#include "batch-app.hpp"
+#include "validator-app.hpp"
+
+#include <algorithm>
+#include <cstdlib>
 
 #include "chop.hpp"
 
 using namespace MAChitgarha::Chop;
 
-int main()
+int main(int argc, char *argv[])
 {
+    // Options might come in any order
+    const bool validate = std::any_of(argv + 1, argv + argc, [](const char *arg) {
+        return std::string{arg} == "--validate";
+    });
+
     try {
-        Zudoku::App{}.run();
+        if (validate) {
+            Zudoku::ValidatorApp app{Zudoku::ValidatorApp::parseArguments(argc, argv)};
+
+            // So scripts could tell whether all files passed
+            return app.run().hasAllPassed() ? EXIT_SUCCESS : EXIT_FAILURE;
+        } else if (argc > 1) {
+            Zudoku::BatchApp{Zudoku::BatchApp::parseArguments(argc, argv)}.run();
+        } else {
+            Zudoku::App{}.run();
+        }
     } catch (std::exception &e) {
         printLine();
         printLine("Oops, something went wrong:");
         printLine(e.what());
+
+        return EXIT_FAILURE;
     }
 
-    return 0;
+    return EXIT_SUCCESS;
 }
@@ -0,0 +1,249 @@
+#include "metrics.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+using namespace Zudoku;
+
+void Metrics::recordSolve(
+    Engine engine,
+    Outcome outcome,
+    std::chrono::steady_clock::duration latency,
+    std::size_t nodesCount
+) {
+    EngineShard &shard = Metrics::getThreadShard()[static_cast<std::size_t>(engine)];
+
+    shard.latency.record(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count()
+    );
+    shard.nodesCount.record(nodesCount);
+
+    Metrics::recordOutcome(engine, outcome);
+}
+
+void Metrics::recordOutcome(Engine engine, Outcome outcome)
+{
+    EngineShard &shard = Metrics::getThreadShard()[static_cast<std::size_t>(engine)];
+
+    shard.outcomeCounts[static_cast<std::size_t>(outcome)]
+        .fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string Metrics::toPrometheusText()
+{
+    /*
+     * A snapshot of all shards merged together. Counters are read one by one, so the
+     * snapshot is not atomic as a whole, which is fine for monitoring purposes.
+     */
+    struct MergedHistogram
+    {
+        std::array<std::uint64_t, Histogram::bucketsCount> counts{};
+        std::uint64_t sum = 0;
+    };
+    struct MergedEngine
+    {
+        MergedHistogram latency, nodesCount;
+        std::array<std::uint64_t, outcomesCount> outcomeCounts{};
+    };
+
+    std::array<MergedEngine, enginesCount> merged;
+
+    const auto mergeHistogram = [](MergedHistogram &to, const Histogram &from) {
+        for (std::size_t i = 0; i < Histogram::bucketsCount; i++) {
+            to.counts[i] += from.counts[i].load(std::memory_order_relaxed);
+        }
+        to.sum += from.sum.load(std::memory_order_relaxed);
+    };
+
+    Metrics::forEachShard([&](const Shard &shard) {
+        for (std::size_t e = 0; e < enginesCount; e++) {
+            mergeHistogram(merged[e].latency, shard[e].latency);
+            mergeHistogram(merged[e].nodesCount, shard[e].nodesCount);
+
+            for (std::size_t o = 0; o < outcomesCount; o++) {
+                merged[e].outcomeCounts[o] +=
+                    shard[e].outcomeCounts[o].load(std::memory_order_relaxed);
+            }
+        }
+    });
+
+    std::ostringstream output;
+
+    /*
+     * Values are recorded as integers, in units of 1/divisor. Integer metrics (i.e. with
+     * a divisor of 1) are written as they are, so large counters keep their exact value.
+     * Others are scaled, with enough precision for the double to round-trip.
+     */
+    const auto writeHistogram = [&output](
+        const std::string &name,
+        const std::string &engineName,
+        const MergedHistogram &histogram,
+        std::uint64_t divisor
+    ) {
+        const std::string labels = "engine=\"" + engineName + "\"";
+        std::uint64_t cumulativeCount = 0;
+
+        const auto writeValue = [&output, divisor](std::uint64_t value) {
+            if (divisor == 1) {
+                output << value;
+            } else {
+                output << std::setprecision(17) << static_cast<double>(value) / divisor;
+            }
+        };
+
+        // Only non-empty buckets are written, as there are about a thousand of them
+        for (std::size_t i = 0; i < Histogram::bucketsCount; i++) {
+            if (histogram.counts[i] == 0) {
+                continue;
+            }
+            cumulativeCount += histogram.counts[i];
+
+            output << name << "_bucket{" << labels << ",le=\"";
+            writeValue(Histogram::getBucketUpperBound(i));
+            output << "\"} " << cumulativeCount << "\n";
+        }
+
+        output << name << "_bucket{" << labels << ",le=\"+Inf\"} "
+            << cumulativeCount << "\n";
+        output << name << "_sum{" << labels << "} ";
+        writeValue(histogram.sum);
+        output << "\n";
+        output << name << "_count{" << labels << "} " << cumulativeCount << "\n";
+    };
+
+    output << "# HELP zudoku_solve_duration_seconds Time spent solving a table.\n";
+    output << "# TYPE zudoku_solve_duration_seconds histogram\n";
+    for (std::size_t e = 0; e < enginesCount; e++) {
+        writeHistogram(
+            "zudoku_solve_duration_seconds",
+            Metrics::getEngineName(static_cast<Engine>(e)),
+            merged[e].latency,
+            1'000'000'000
+        );
+    }
+
+    output << "# HELP zudoku_solve_nodes Search nodes visited to solve a table, by all "
+        "solvers racing on it for the portfolio engine.\n";
+    output << "# TYPE zudoku_solve_nodes histogram\n";
+    for (std::size_t e = 0; e < enginesCount; e++) {
+        writeHistogram(
+            "zudoku_solve_nodes",
+            Metrics::getEngineName(static_cast<Engine>(e)),
+            merged[e].nodesCount,
+            1
+        );
+    }
+
+    output << "# HELP zudoku_solves_total Tables given to the solver, by outcome.\n";
+    output << "# TYPE zudoku_solves_total counter\n";
+    for (std::size_t e = 0; e < enginesCount; e++) {
+        for (std::size_t o = 0; o < outcomesCount; o++) {
+            output << "zudoku_solves_total{engine=\""
+                << Metrics::getEngineName(static_cast<Engine>(e))
+                << "\",outcome=\""
+                << Metrics::getOutcomeName(static_cast<Outcome>(o))
+                << "\"} " << merged[e].outcomeCounts[o] << "\n";
+        }
+    }
+
+    return output.str();
+}
+
+void Metrics::saveToFile(const std::string &path)
+{
+    const std::string temporaryPath = path + ".tmp";
+
+    {
+        std::ofstream file;
+        file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+
+        file.open(temporaryPath);
+        file << Metrics::toPrometheusText();
+    }
+
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        throw std::ios_base::failure("Could not rename the temporary metrics file");
+    }
+}
+
+std::size_t Metrics::Histogram::getBucketIndex(std::uint64_t value) noexcept
+{
+    if (value < subBucketsCount) {
+        return value;
+    }
+
+    unsigned int highestBit = 63;
+    while ((value >> highestBit) == 0) {
+        highestBit--;
+    }
+
+    const unsigned int shift = highestBit - subBucketBits;
+
+    return (shift + 1) * subBucketsCount + ((value >> shift) & (subBucketsCount - 1));
+}
+
+std::uint64_t Metrics::Histogram::getBucketUpperBound(std::size_t index) noexcept
+{
+    if (index < subBucketsCount) {
+        return index;
+    }
+
+    const unsigned int shift = index / subBucketsCount - 1;
+    const std::uint64_t lowerBound = (subBucketsCount + index % subBucketsCount) << shift;
+
+    return lowerBound + ((std::uint64_t{1} << shift) - 1);
+}
+
+void Metrics::Histogram::record(std::uint64_t value) noexcept
+{
+    this->counts[Histogram::getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    this->sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+Metrics::ShardRegistry &Metrics::getShardRegistry()
+{
+    // Never destroyed, as threads might still record while the program exits
+    static ShardRegistry *registry = new ShardRegistry;
+
+    return *registry;
+}
+
+Metrics::Shard &Metrics::getThreadShard()
+{
+    thread_local Shard *shard = [] {
+        ShardRegistry &registry = Metrics::getShardRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+
+        return registry.shards.emplace_back(std::make_unique<Shard>()).get();
+    }();
+
+    return *shard;
+}
+
+std::string Metrics::getEngineName(Engine engine)
+{
+    switch (engine) {
+        case Engine::Solver:
+            return "solver";
+        case Engine::Portfolio:
+            return "portfolio";
+    }
+    return "unknown";
+}
+
+std::string Metrics::getOutcomeName(Outcome outcome)
+{
+    switch (outcome) {
+        case Outcome::Solved:
+            return "solved";
+        case Outcome::NoSolution:
+            return "no_solution";
+        case Outcome::Invalid:
+            return "invalid";
+        case Outcome::MultipleSolutions:
+            return "multiple_solutions";
+    }
+    return "unknown";
+}
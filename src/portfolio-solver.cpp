@@ -0,0 +1,108 @@
+#include "portfolio-solver.hpp"
+
+#include <thread>
+
+using namespace Zudoku;
+
+using CellOrder = SudokuSolver::Strategy::CellOrder;
+
+PortfolioSolver::PortfolioSolver(SudokuSolver::Table table, std::vector<Entry> entries):
+    table(table),
+    entries(std::move(entries))
+{
+    if (this->entries.empty()) {
+        throw std::invalid_argument("Expected at least one portfolio entry");
+    }
+}
+
+std::vector<PortfolioSolver::Entry> PortfolioSolver::getDefaultEntries()
+{
+    return {
+        {"static", {CellOrder::Static, 0}, false},
+        {"mrv", {CellOrder::MinimumRemainingValues, 0}, false},
+        {"mrv-shuffled-restarts", {CellOrder::MinimumRemainingValues, 1}, true},
+    };
+}
+
+PortfolioSolver::Result PortfolioSolver::solve()
+{
+    std::vector<std::thread> threads;
+
+    for (const Entry &entry: this->entries) {
+        threads.emplace_back(&Self::race, this, std::cref(entry));
+    }
+    for (std::thread &thread: threads) {
+        thread.join();
+    }
+
+    if (this->exception) {
+        std::rethrow_exception(this->exception);
+    }
+
+    this->result.nodesCount = this->nodesCount.load(std::memory_order_relaxed);
+
+    return this->result;
+}
+
+void PortfolioSolver::race(const Entry &entry)
+{
+    SudokuSolver::Strategy strategy = entry.strategy;
+    std::size_t restartNodesCount = Self::initialRestartNodesCount;
+
+    try {
+        do {
+            SudokuSolver solver{this->table, strategy};
+            solver.prepare();
+
+            SudokuSolver::State state = SudokuSolver::State::Searching;
+
+            while (!this->finished.load(std::memory_order_relaxed)) {
+                state = solver.step(Self::stepNodesCount);
+
+                if (state != SudokuSolver::State::Searching) {
+                    break;
+                }
+                if (entry.restarts && solver.getNodesCount() >= restartNodesCount) {
+                    break;
+                }
+            }
+
+            // Losers and abandoned attempts count as well, as the work is done anyway
+            this->nodesCount.fetch_add(solver.getNodesCount(), std::memory_order_relaxed);
+
+            switch (state) {
+                case SudokuSolver::State::Solved:
+                    return this->finish(entry, solver);
+
+                // Running out of possibilities is a proof, no matter the strategy
+                case SudokuSolver::State::Exhausted:
+                    return this->finish(
+                        std::make_exception_ptr(SudokuSolver::NoSolutionError{})
+                    );
+
+                default:
+                    break;
+            }
+
+            strategy.shuffleSeed++;
+            restartNodesCount *= 2;
+        } while (!this->finished.load(std::memory_order_relaxed));
+    } catch (...) {
+        this->finish(std::current_exception());
+    }
+}
+
+void PortfolioSolver::finish(const Entry &entry, const SudokuSolver &solver)
+{
+    if (!this->finished.exchange(true)) {
+        // Only the winner gets here, and others are joined before reading the result
+        this->result = {solver.getTable(), entry.name, 0};
+    }
+}
+
+void PortfolioSolver::finish(std::exception_ptr exception)
+{
+    if (!this->finished.exchange(true)) {
+        this->exception = exception;
+    }
+}
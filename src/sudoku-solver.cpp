@@ -1,5 +1,8 @@
 #include "sudoku-solver.hpp"
 
+#include <algorithm>
+#include <limits>
+
 using namespace Zudoku;
 
 SudokuSolver::SudokuSolver(Table table):
@@ -12,17 +15,80 @@ SudokuSolver::SudokuSolver(Table &&table):
 {
 }
 
+SudokuSolver::SudokuSolver(Table table, Strategy strategy):
+    table(table),
+    strategy(strategy),
+    randomEngine(strategy.shuffleSeed)
+{
+}
+
 SudokuSolver::This SudokuSolver::solve()
 {
+    if (this->state == State::Unprepared) {
+        this->prepare();
+    }
+
+    while (this->state != State::Solved) {
+        if (this->step(std::numeric_limits<std::size_t>::max()) == State::Exhausted) {
+            throw NoSolutionError{};
+        }
+    }
+
+    return *this;
+}
+
+SudokuSolver::This SudokuSolver::prepare()
+{
+    if (this->state != State::Unprepared) {
+        throw std::logic_error("The solver must only be prepared once");
+    }
+
+    // If validation throws halfway, the data is left partially made, and is unusable
+    this->state = State::Exhausted;
+
     (*this)
         .makeEmptyCellsAndBlocksData()
         .makeEmptyCellsPossibilities()
-        .sortEmptyCellsByPossibilitiesCount()
-        .tryEmptyCellsPossibilities();
+        .sortEmptyCellsByPossibilitiesCount();
+
+    this->state = this->emptyCells.toBeFilled.empty() ? State::Solved : State::Searching;
 
     return *this;
 }
 
+SudokuSolver::State SudokuSolver::step(std::size_t maxNodesCount)
+{
+    if (this->state == State::Unprepared) {
+        throw std::logic_error("The solver must be prepared before stepping");
+    }
+
+    if (this->state == State::Solved) {
+        // Pretending the last filled cell has led to a dead end
+        if (this->emptyCells.filled.empty()) {
+            this->state = State::Exhausted;
+        } else {
+            this->emptyCells.toBeFilled.push(this->emptyCells.filled.move_top());
+            this->state = State::Searching;
+        }
+    }
+
+    if (this->state == State::Searching) {
+        this->tryEmptyCellsPossibilities(maxNodesCount);
+    }
+
+    return this->state;
+}
+
+SudokuSolver::State SudokuSolver::getState() const noexcept
+{
+    return this->state;
+}
+
+std::size_t SudokuSolver::getNodesCount() const noexcept
+{
+    return this->nodesCount;
+}
+
 SudokuSolver::Table SudokuSolver::getTable() const
 {
     return this->table;
@@ -60,7 +126,7 @@ SudokuSolver::This SudokuSolver::setValueExistInBlocks(
             throw std::invalid_argument(flossy::format(
                 "Two equal values encountered in {} {} of the table (value: {})",
                 b.name,
-                static_cast<unsigned int>(b.indexGetter(index)) + 1,
+                Self::getBlockIndex(b, index) + 1,
                 static_cast<unsigned int>(value)
             ));
         }
@@ -77,12 +143,23 @@ SudokuSolver::This SudokuSolver::makeEmptyCellsPossibilities()
     while (!this->emptyCells.toBeFilled.empty()) {
         EmptyCellData cell = this->emptyCells.toBeFilled.move_top();
 
+        std::array<CellValue, 9> values;
+        size_t valuesCount = 0;
+
         for (size_t i = 1; i <= 9; i++) {
             if (!this->doesValueExistInAnySharedBlocks(cell.index, i)) {
-                cell.possibilities.untried.push(i);
+                values[valuesCount++] = i;
             }
         }
 
+        if (this->strategy.shuffleSeed != 0) {
+            std::shuffle(values.begin(), values.begin() + valuesCount, this->randomEngine);
+        }
+
+        for (size_t i = 0; i < valuesCount; i++) {
+            cell.possibilities.untried.push(values[i]);
+        }
+
         helper.push(std::move(cell));
     }
 
@@ -100,8 +177,11 @@ SudokuSolver::This SudokuSolver::sortEmptyCellsByPossibilitiesCount()
         tmpStacks[cell.possibilities.untried.size()].push(std::move(cell));
     }
 
-    // Possililities of an empty cell must not be empty at the very beginning
-    for (size_t i = 9; i > 0; i--) {
+    /*
+     * Cells without any possibilities are pushed last, so they are tried first and the
+     * search is exhausted immediately, instead of leaving them empty.
+     */
+    for (size_t i = 10; i-- > 0;) {
         while (!tmpStacks[i].empty()) {
             this->emptyCells.toBeFilled.push(
                 std::move(tmpStacks[i].move_top())
@@ -112,10 +192,16 @@ SudokuSolver::This SudokuSolver::sortEmptyCellsByPossibilitiesCount()
     return *this;
 }
 
-SudokuSolver::This SudokuSolver::tryEmptyCellsPossibilities()
+SudokuSolver::This SudokuSolver::tryEmptyCellsPossibilities(std::size_t maxNodesCount)
 {
-    // While filling the table completely
-    while (!this->emptyCells.toBeFilled.empty()) {
+    // While filling the table completely, or running out of nodes for this step
+    for (; maxNodesCount > 0 && !this->emptyCells.toBeFilled.empty(); maxNodesCount--) {
+        this->nodesCount++;
+
+        if (this->strategy.cellOrder == Strategy::CellOrder::MinimumRemainingValues) {
+            this->bringMostConstrainedEmptyCellToTop();
+        }
+
         EmptyCellData curEmptyCell = this->emptyCells.toBeFilled.move_top();
 
         NextCorrectPossibility p = this->findNextCorrectPossibility(curEmptyCell);
@@ -131,10 +217,39 @@ SudokuSolver::This SudokuSolver::tryEmptyCellsPossibilities()
             curEmptyCell.possibilities.untried.swap(curEmptyCell.possibilities.tried);
 
             this->emptyCells.toBeFilled.push(std::move(curEmptyCell));
+
+            // Nothing left to revert back to, so all the possibilities are tried
+            if (this->emptyCells.filled.empty()) {
+                this->state = State::Exhausted;
+                return *this;
+            }
+
             this->emptyCells.toBeFilled.push(this->emptyCells.filled.move_top());
         }
     }
 
+    if (this->emptyCells.toBeFilled.empty()) {
+        this->state = State::Solved;
+    }
+
+    return *this;
+}
+
+SudokuSolver::This SudokuSolver::bringMostConstrainedEmptyCellToTop()
+{
+    /*
+     * If the top cell is already tried, we are reverting back to it, and its value must
+     * be changed before anything else. Otherwise, none of the cells are tried yet, and
+     * choosing between them is up to us.
+     */
+    if (!this->emptyCells.toBeFilled.top().possibilities.tried.empty()) {
+        return *this;
+    }
+
+    this->emptyCells.toBeFilled.swap_min_to_top([this](const EmptyCellData &cell) {
+        return this->countValidPossibilities(cell.index);
+    });
+
     return *this;
 }
 
@@ -185,3 +300,16 @@ SudokuSolver::NextCorrectPossibility SudokuSolver::findNextCorrectPossibility(
 
     return possibility;
 }
+
+unsigned int SudokuSolver::countValidPossibilities(const CellIndex &index) const
+{
+    unsigned int count = 0;
+
+    for (size_t i = 1; i <= 9; i++) {
+        if (!this->doesValueExistInAnySharedBlocks(index, i)) {
+            count++;
+        }
+    }
+
+    return count;
+}
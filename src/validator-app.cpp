@@ -0,0 +1,165 @@
+#include "validator-app.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "chop.hpp"
+
+using namespace Zudoku;
+using namespace MAChitgarha::Chop;
+
+ValidatorApp::ValidatorApp(Options options):
+    options(std::move(options))
+{
+}
+
+ValidatorApp::Options ValidatorApp::parseArguments(int argc, const char *const argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+
+        if (arg == "--validate") {
+            continue;
+        }
+        if (arg == "--complete") {
+            options.requireComplete = true;
+            continue;
+        }
+        if (arg == "--puzzle") {
+            if (++i == argc) {
+                throw std::invalid_argument("Expected a file path after --puzzle");
+            }
+            options.puzzleCsvFilePath = argv[i];
+            continue;
+        }
+
+        if (arg.rfind("--", 0) == 0) {
+            throw std::invalid_argument(flossy::format("Unknown option {}", arg));
+        }
+
+        options.inputCsvFilePaths.push_back(arg);
+    }
+
+    if (options.inputCsvFilePaths.empty()) {
+        throw std::invalid_argument("Expected at least one input CSV file path");
+    }
+
+    return options;
+}
+
+ValidatorApp::This ValidatorApp::run()
+{
+    GridValidator::Grid puzzle;
+    GridValidator::Options validatorOptions = {this->options.requireComplete, nullptr};
+
+    if (!this->options.puzzleCsvFilePath.empty()) {
+        // Nothing could be checked without the puzzle, so let it throw
+        puzzle = this->readGrid(this->options.puzzleCsvFilePath);
+        validatorOptions.puzzle = &puzzle;
+    }
+
+    std::vector<Entry> batch;
+    batch.reserve(Self::batchSize);
+
+    for (const std::string &path: this->options.inputCsvFilePaths) {
+        batch.push_back(this->readEntry(path));
+
+        if (batch.size() == Self::batchSize) {
+            this->validateBatch(batch, validatorOptions);
+            batch.clear();
+        }
+    }
+    this->validateBatch(batch, validatorOptions);
+
+    printLine();
+    printLine(flossy::format(
+        "Checked {} file(s): {} valid, {} invalid, {} unreadable.",
+        this->options.inputCsvFilePaths.size(),
+        this->filesCount.valid,
+        this->filesCount.invalid,
+        this->filesCount.unreadable
+    ));
+
+    return *this;
+}
+
+bool ValidatorApp::hasAllPassed() const noexcept
+{
+    return this->filesCount.invalid + this->filesCount.unreadable == 0;
+}
+
+ValidatorApp::Entry ValidatorApp::readEntry(const std::string &inputCsvFilePath)
+{
+    Entry entry{inputCsvFilePath, {}, {}};
+
+    try {
+        entry.grid = this->readGrid(inputCsvFilePath);
+    } catch (std::ios_base::failure &) {
+        entry.error = "Could not read the file";
+    } catch (std::exception &e) {
+        entry.error = e.what();
+    }
+
+    return entry;
+}
+
+GridValidator::Grid ValidatorApp::readGrid(const std::string &inputCsvFilePath)
+{
+    const rapidcsv::Document csvData = this->readCsvFileData(inputCsvFilePath);
+    GridValidator::Grid grid;
+
+    for (size_t i = 0; i < csvData.GetRowCount(); i++) {
+        for (size_t j = 0; j < csvData.GetColumnCount(); j++) {
+            // Saturating, so huge values are still reported as out of range
+            grid[j][i] = std::min(csvData.GetCell<unsigned int>(i, j), 255u);
+        }
+    }
+
+    return grid;
+}
+
+ValidatorApp::This ValidatorApp::validateBatch(
+    const std::vector<Entry> &batch,
+    const GridValidator::Options &validatorOptions
+) {
+    std::vector<GridValidator::Grid> grids;
+    grids.reserve(batch.size());
+
+    for (const Entry &entry: batch) {
+        if (entry.error.empty()) {
+            grids.push_back(entry.grid);
+        }
+    }
+
+    // The fast check is enough for valid grids, which should be the common case
+    std::array<bool, Self::batchSize> results;
+    GridValidator::isValid(grids.data(), grids.size(), results.data(), validatorOptions);
+
+    std::size_t gridIndex = 0;
+
+    for (const Entry &entry: batch) {
+        if (!entry.error.empty()) {
+            this->filesCount.unreadable++;
+            printLine("Error: ", entry.inputCsvFilePath, ": ", entry.error);
+            continue;
+        }
+
+        if (results[gridIndex++]) {
+            this->filesCount.valid++;
+            continue;
+        }
+
+        this->filesCount.invalid++;
+        printLine(entry.inputCsvFilePath, ": Invalid");
+
+        for (const GridValidator::Conflict &conflict:
+            GridValidator::findConflicts(entry.grid, validatorOptions)
+        ) {
+            printLine("    ", GridValidator::describeConflict(conflict));
+        }
+    }
+
+    return *this;
+}